@@ -11,12 +11,13 @@
 #include <climits>
 #include <iomanip>
 #include <cstdlib>
+#include <cmath>
 
 using namespace std;
 
 void printHelp() {
     cout << "Использование программы:" << endl;
-    cout << "  program.exe [-type weighted|unweighted] [-orientation directed|undirected] [-n N] [-density D] [-min MIN] [-max MAX] [-help]" << endl;
+    cout << "  program.exe [-type weighted|unweighted] [-orientation directed|undirected] [-n N] [-density D] [-min MIN] [-max MAX] [-approx K] [-help]" << endl;
     cout << endl;
     cout << "Параметры командной строки:" << endl;
     cout << "  -type <тип>          : weighted - взвешенный граф (по умолчанию)" << endl;
@@ -27,12 +28,15 @@ void printHelp() {
     cout << "  -density <процент>   : процент рёбер между вершинами (0-100)" << endl;
     cout << "  -min <вес>           : минимальный вес рёбер (только для взвешенного графа)" << endl;
     cout << "  -max <вес>           : максимальный вес рёбер (только для взвешенного графа)" << endl;
+    cout << "  -approx <число>      : приближённый анализ по K выборочным вершинам-источникам" << endl;
+    cout << "                        : (оценки эксцентриситетов с границами погрешности)" << endl;
     cout << "  -help                : показать эту справку" << endl;
     cout << endl;
     cout << "Примеры:" << endl;
     cout << "  program.exe -type weighted -orientation directed -n 10 -density 50 -min 1 -max 10" << endl;
     cout << "  program.exe -orientation undirected -n 8 -density 30" << endl;
     cout << "  program.exe -type unweighted -n 5 -density 40" << endl;
+    cout << "  program.exe -n 2000 -density 1 -approx 16" << endl;
     cout << endl;
     cout << "Если параметры не указаны, программа запросит их в интерактивном режиме." << endl;
 }
@@ -371,21 +375,35 @@ vector<int> DFSD_iterative_list(const vector<vector<int>>& adjList, int v) {
     return DIST;
 }
 
+vector<int> findDistancesFrom(const vector<vector<int>>& G, int v, bool weighted) {
+    if (weighted) {
+        return BFSD_weighted_matrix(G, v);
+    }
+    return BFSD_unweighted_matrix(G, v);
+}
+
 vector<vector<int>> findAllDistances(const vector<vector<int>>& G, bool directed, bool weighted) {
     int n = G.size();
     vector<vector<int>> allDist(n);
 
     for (int i = 0; i < n; i++) {
-        if (weighted) {
-            allDist[i] = BFSD_weighted_matrix(G, i);
-        }
-        else {
-            allDist[i] = BFSD_unweighted_matrix(G, i);
-        }
+        allDist[i] = findDistancesFrom(G, i, weighted);
     }
     return allDist;
 }
 
+vector<vector<int>> transposeMatrix(const vector<vector<int>>& G) {
+    int n = G.size();
+    vector<vector<int>> T(n, vector<int>(n, 0));
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            T[j][i] = G[i][j];
+        }
+    }
+    return T;
+}
+
 void analyzeGraph(const vector<vector<int>>& allDist, const string& graphType, bool weighted) {
     int n = allDist.size();
     vector<int> eccentricity(n, 0);
@@ -475,6 +493,210 @@ void analyzeGraph(const vector<vector<int>>& allDist, const string& graphType, b
     cout << "}" << endl;
 }
 
+bool isReachable(int dist) {
+    return dist != INT_MAX && dist != -1;
+}
+
+string formatEccentricity(int value) {
+    if (value == INT_MAX) return "∞";
+    return to_string(value);
+}
+
+// Длинные списки вершин заменяются их количеством, чтобы не засорять вывод на больших графах
+const int MAX_LISTED_VERTICES = 50;
+
+void printVertexList(const vector<int>& vertices) {
+    if (vertices.empty()) {
+        cout << "отсутствуют";
+    }
+    else if ((int)vertices.size() > MAX_LISTED_VERTICES) {
+        cout << vertices.size() << " вершин";
+    }
+    else {
+        for (int v : vertices) {
+            cout << (v + 1) << " ";
+        }
+    }
+    cout << endl;
+}
+
+// Приближённый анализ: поиск расстояний запускается только из k вершин-источников.
+// Первые два источника образуют двойной обход (случайная вершина и самая удалённая от неё),
+// остальные выбираются случайно. Для каждой вершины v и источника s по неравенству треугольника:
+//   ecc(v) >= d(v,s),  ecc(v) >= ecc(s) - d(s,v),  ecc(v) <= d(v,s) + ecc(s).
+// Для ориентированного графа d(v,s) берётся из поиска по транспонированной матрице.
+void analyzeGraphApprox(const vector<vector<int>>& G, const string& graphType, bool directed, bool weighted, int k) {
+    int n = G.size();
+    vector<int> lower(n, 0);
+    vector<int> upper(n, INT_MAX);   // INT_MAX - оценка сверху ещё не получена
+    vector<bool> infinite(n, false); // доказано, что эксцентриситет бесконечен
+    vector<bool> used(n, false);
+
+    vector<vector<int>> reversed;
+    if (directed) {
+        reversed = transposeMatrix(G);
+    }
+
+    random_device rd;
+    mt19937 gen(rd());
+    vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = i;
+    shuffle(order.begin(), order.end(), gen);
+
+    cout << "\n=== ПРИБЛИЖЁННЫЙ АНАЛИЗ " << graphType << " ГРАФА ===" << endl;
+    cout << "Тип графа: " << (weighted ? "взвешенный" : "невзвешенный") << endl;
+    cout << "Число источников: " << k << " из " << n << endl;
+
+    int nextRandom = 0;
+    int randomSources = 0;
+    int farthest = -1;
+    int sweepBound = -1;
+
+    cout << "Источники: ";
+    for (int step = 0; step < k; step++) {
+        int s;
+        bool sweep = step == 1 && farthest != -1 && !used[farthest];
+        if (sweep) {
+            s = farthest;
+        }
+        else {
+            while (used[order[nextRandom]]) nextRandom++;
+            s = order[nextRandom];
+            randomSources++;
+        }
+        used[s] = true;
+        cout << (s + 1) << " ";
+
+        vector<int> fwd = findDistancesFrom(G, s, weighted);
+        vector<int> back = directed ? findDistancesFrom(reversed, s, weighted) : fwd;
+
+        int ecc = 0;
+        bool sourceInfinite = false;
+        farthest = -1;
+        for (int v = 0; v < n; v++) {
+            if (!isReachable(fwd[v])) {
+                sourceInfinite = true;
+            }
+            else if (fwd[v] >= ecc) {
+                ecc = fwd[v];
+                farthest = v;
+            }
+        }
+
+        for (int v = 0; v < n; v++) {
+            // v не достигает s, либо s не достигает некоторой вершины, а v достигается из s
+            if (!isReachable(back[v]) || (sourceInfinite && isReachable(fwd[v]))) {
+                infinite[v] = true;
+                continue;
+            }
+            lower[v] = max(lower[v], back[v]);
+            if (!sourceInfinite) {
+                upper[v] = min(upper[v], back[v] + ecc);
+                if (isReachable(fwd[v])) {
+                    lower[v] = max(lower[v], ecc - fwd[v]);
+                }
+            }
+        }
+
+        if (sweep && !sourceInfinite) {
+            sweepBound = ecc;
+        }
+    }
+    cout << endl;
+
+    int diameterLower = 0;
+    int diameterUpper = 0;
+    int radiusLower = INT_MAX;
+    int radiusUpper = INT_MAX;
+    int unknown = 0;
+
+    for (int v = 0; v < n; v++) {
+        if (infinite[v]) continue;
+        if (upper[v] == INT_MAX) {
+            unknown++;
+        }
+        else {
+            diameterLower = max(diameterLower, lower[v]);
+            diameterUpper = max(diameterUpper, upper[v]);
+            radiusUpper = min(radiusUpper, upper[v]);
+        }
+        radiusLower = min(radiusLower, lower[v]);
+    }
+    if (unknown > 0) {
+        diameterUpper = INT_MAX;
+    }
+
+    cout << "\nЭксцентриситеты вершин ([нижняя граница; верхняя граница], погрешность = их разность): " << endl;
+    for (int v = 0; v < n; v++) {
+        cout << "  Вершина " << (v + 1) << ": ";
+        if (infinite[v]) {
+            cout << "∞ (недостижимы некоторые вершины)";
+        }
+        else if (lower[v] == upper[v]) {
+            cout << lower[v] << (used[v] ? " (источник)" : " (точно)");
+        }
+        else {
+            cout << "[" << lower[v] << "; " << formatEccentricity(upper[v]) << "]";
+            if (upper[v] != INT_MAX) {
+                cout << ", погрешность ≤ " << (upper[v] - lower[v]);
+            }
+        }
+        cout << endl;
+    }
+
+    if (sweepBound != -1) {
+        cout << "\nНижняя оценка диаметра двойным обходом: " << sweepBound << endl;
+    }
+    cout << "\nДИАМЕТР графа: [" << diameterLower << "; " << formatEccentricity(diameterUpper) << "]" << endl;
+    cout << "РАДИУС графа: [" << formatEccentricity(radiusLower) << "; " << formatEccentricity(radiusUpper) << "]" << endl;
+    if (unknown > 0) {
+        cout << "Вершин без верхней оценки эксцентриситета: " << unknown << endl;
+    }
+
+    if (randomSources > 0) {
+        // Вероятность, что ни один из r случайных источников не попал в долю q вершин, равна (1 - q)^r.
+        // Оба события (верхняя и нижняя доли) вместе выполняются с вероятностью >= 1 - 2 * 0.025 = 95%
+        double q = 1.0 - pow(0.025, 1.0 / randomSources);
+        cout << "С вероятностью 95% среди " << randomSources << " случайных источников одновременно есть вершина из "
+            << fixed << setprecision(1) << q * 100 << "% вершин с наибольшим и вершина из "
+            << q * 100 << "% вершин с наименьшим эксцентриситетом" << endl;
+        cout.unsetf(ios::fixed);
+        cout << setprecision(6);
+    }
+
+    vector<int> peripheral;
+    vector<int> central;
+    for (int v = 0; v < n; v++) {
+        if (infinite[v]) continue;
+        if (upper[v] >= diameterLower) peripheral.push_back(v);
+        if (lower[v] <= radiusUpper) central.push_back(v);
+    }
+
+    cout << "\nКАНДИДАТЫ В ПЕРИФЕРИЙНЫЕ ВЕРШИНЫ (верхняя граница >= " << diameterLower << "): ";
+    printVertexList(peripheral);
+    cout << "КАНДИДАТЫ В ЦЕНТРАЛЬНЫЕ ВЕРШИНЫ (нижняя граница <= " << formatEccentricity(radiusUpper) << "): ";
+    printVertexList(central);
+
+    cout << "ЛУЧШИЙ НАЙДЕННЫЙ ИСТОЧНИК (эксцентриситет = " << formatEccentricity(radiusUpper) << "): ";
+    bool hasBest = false;
+    for (int v = 0; v < n; v++) {
+        if (used[v] && !infinite[v] && upper[v] == radiusUpper) {
+            cout << (v + 1) << " ";
+            hasBest = true;
+        }
+    }
+    if (!hasBest) cout << "отсутствует";
+    cout << endl;
+
+    // Верхняя граница не больше нижней оценки радиуса - эксцентриситет точно равен радиусу
+    vector<int> center;
+    for (int v = 0; v < n; v++) {
+        if (!infinite[v] && upper[v] <= radiusLower) center.push_back(v);
+    }
+    cout << "ЦЕНТР графа (подтверждённые вершины): ";
+    printVertexList(center);
+}
+
 int main(int argc, char* argv[]) {
     setlocale(LC_ALL, "Russian");
 
@@ -485,6 +707,7 @@ int main(int argc, char* argv[]) {
     int densityPercent = -1;
     int minWeight = 1;
     int maxWeight = 10;
+    int approxSources = 0; // 0 означает точный анализ по всем вершинам
 
     // Обработка аргументов командной строки
     if (argc > 1) {
@@ -561,6 +784,17 @@ int main(int argc, char* argv[]) {
                     i++;
                 }
             }
+            else if (arg == "-approx") {
+                if (i + 1 < argc) {
+                    approxSources = atoi(argv[i + 1]);
+                    if (approxSources <= 0) {
+                        cout << "Ошибка: число источников должно быть положительным числом" << endl;
+                        printHelp();
+                        return 1;
+                    }
+                    i++;
+                }
+            }
             else if (arg == "-help") {
                 printHelp();
                 return 0;
@@ -627,10 +861,15 @@ int main(int argc, char* argv[]) {
         matrix = generateUnweightedAdjacencyMatrix(n, density, directed);
     }
 
-    printMatrix(matrix);
-
+    bool approx = approxSources > 0 && approxSources < n;
     auto adjList = convertToAdjacencyList(matrix);
-    printAdjacencyList(adjList, matrix, weighted);
+    if (approx) {
+        cout << "Матрица и списки смежности не выводятся в режиме приближённого анализа" << endl;
+    }
+    else {
+        printMatrix(matrix);
+        printAdjacencyList(adjList, matrix, weighted);
+    }
 
     cout << "\nПоиск расстояний BFS из вершины 1:" << endl;
     vector<int> distances;
@@ -659,9 +898,17 @@ int main(int argc, char* argv[]) {
 
     cout << "\n=== ЗАДАНИЕ 2 ===" << endl;
 
-    auto allDistances = findAllDistances(matrix, directed, weighted);
     string graphType = directed ? "ОРИЕНТИРОВАННОГО" : "НЕОРИЕНТИРОВАННОГО";
-    analyzeGraph(allDistances, graphType, weighted);
+    if (approx) {
+        analyzeGraphApprox(matrix, graphType, directed, weighted, approxSources);
+    }
+    else {
+        if (approxSources > 0) {
+            cout << "Число источников (" << approxSources << ") не меньше числа вершин, выполняется точный анализ" << endl;
+        }
+        auto allDistances = findAllDistances(matrix, directed, weighted);
+        analyzeGraph(allDistances, graphType, weighted);
+    }
 
     cout << "\n=== ИНФОРМАЦИЯ О ПАРАМЕТРАХ ===" << endl;
     cout << "Для полного задания параметров через командную строку используйте:" << endl;